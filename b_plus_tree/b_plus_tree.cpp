@@ -1,5 +1,7 @@
 #include "include/b_plus_tree.h"
 
+#include <algorithm>
+
 #define DEBUG 0
 #if DEBUG
 #include <iostream>
@@ -190,6 +192,95 @@ BPlusTree::RangeScan(const KeyType &key_start, const KeyType &key_end,
   return;
 }
 
+/*****************************************************************************
+ * MERGE_JOIN & SET_OPERATIONS
+ *****************************************************************************/
+/*
+ * Walk the leaf chains of both trees in lockstep and report every key present
+ * in both trees together with its value in each tree.
+ * Whenever one side falls behind, it seeks directly to the key of the other
+ * side instead of scanning through the gap, so skewed inputs cost roughly the
+ * size of the output rather than the size of the larger tree.
+ */
+void
+BPlusTree::Join(BPlusTree &other, const JoinCallback &callback) {
+  Cursor left {FirstLeaf(), 0}, right {other.FirstLeaf(), 0};
+  while (left.leaf and right.leaf) {
+    KeyType const &left_key {left.leaf->keys[left.index]};
+    KeyType const &right_key {right.leaf->keys[right.index]};
+    if (left_key < right_key) { Seek(left, right_key); }
+    else if (right_key < left_key) { other.Seek(right, left_key); }
+    else {
+      callback(left_key, left.leaf->pointers[left.index],
+               right.leaf->pointers[right.index]);
+      Advance(left); Advance(right);
+    }
+  }
+  return;
+}
+
+/*
+ * Report every key present in both trees with its value in this tree
+ */
+void
+BPlusTree::Intersect(BPlusTree &other, const ScanCallback &callback) {
+  Join(other, [&callback](const KeyType &key, const RecordPointer &value,
+                          const RecordPointer &) { callback(key, value); });
+  return;
+}
+
+/*
+ * Report every key present in either tree in ascending order. A key present
+ * in both trees is reported once, with its value in this tree.
+ * Every key is part of the output, so both leaf chains are scanned entirely.
+ */
+void
+BPlusTree::Union(BPlusTree &other, const ScanCallback &callback) {
+  Cursor left {FirstLeaf(), 0}, right {other.FirstLeaf(), 0};
+  while (left.leaf and right.leaf) {
+    KeyType const &left_key {left.leaf->keys[left.index]};
+    KeyType const &right_key {right.leaf->keys[right.index]};
+    if (right_key < left_key) {
+      callback(right_key, right.leaf->pointers[right.index]);
+      Advance(right);
+      continue;
+    }
+    if (not (left_key < right_key)) { Advance(right); }
+    callback(left_key, left.leaf->pointers[left.index]);
+    Advance(left);
+  }
+  for (; left.leaf; Advance(left)) {
+    callback(left.leaf->keys[left.index], left.leaf->pointers[left.index]);
+  }
+  for (; right.leaf; Advance(right)) {
+    callback(right.leaf->keys[right.index], right.leaf->pointers[right.index]);
+  }
+  return;
+}
+
+/*
+ * Report every key of this tree that is absent from the other tree.
+ * This tree is scanned entirely while the other tree only seeks to the keys
+ * of this tree, skipping the gaps in between.
+ */
+void
+BPlusTree::Difference(BPlusTree &other, const ScanCallback &callback) {
+  Cursor left {FirstLeaf(), 0}, right {other.FirstLeaf(), 0};
+  while (left.leaf and right.leaf) {
+    KeyType const &left_key {left.leaf->keys[left.index]};
+    KeyType const &right_key {right.leaf->keys[right.index]};
+    if (left_key < right_key) {
+      callback(left_key, left.leaf->pointers[left.index]);
+      Advance(left);
+    } else if (right_key < left_key) { other.Seek(right, left_key); }
+    else { Advance(left); Advance(right); }
+  }
+  for (; left.leaf; Advance(left)) {
+    callback(left.leaf->keys[left.index], left.leaf->pointers[left.index]);
+  }
+  return;
+}
+
 // private
 
 LeafNode*
@@ -216,6 +307,51 @@ BPlusTree::FindLeaf(KeyType const &key, bool is_predecessor) {
   return nullptr;
 }
 
+LeafNode*
+BPlusTree::FirstLeaf() const {
+  if (not root) { return nullptr; }
+  Node *node {root};
+  while (not node->is_leaf) {
+    node = static_cast<InternalNode*>(node)->children[0];
+  }
+  return static_cast<LeafNode*>(node);
+}
+
+/*
+ * Move the cursor forward to the first key not less than the given key.
+ * Nearby targets are reached by following next_leaf for a few hops, farther
+ * ones by descending again from the root, and the final position inside the
+ * leaf is found by binary search.
+ */
+void
+BPlusTree::Seek(Cursor &cursor, KeyType const &key) {
+  static constexpr int max_hops {2};
+  LeafNode *leaf {cursor.leaf};
+  int index {cursor.index};
+  for (int hops {}; leaf and leaf->keys[leaf->key_num - 1] < key; ++hops) {
+    index = 0;
+    if (hops < max_hops) { leaf = leaf->next_leaf; continue; }
+    // large gap
+    leaf = FindLeaf(key, true);
+    if (leaf->keys[leaf->key_num - 1] < key) { leaf = leaf->next_leaf; }
+    break;
+  }
+  if (not leaf) { cursor = {nullptr, 0}; return; }
+  KeyType *first {std::lower_bound(leaf->keys + index,
+                                   leaf->keys + leaf->key_num, key)};
+  cursor = {leaf, static_cast<int>(first - leaf->keys)};
+  return;
+}
+
+void
+BPlusTree::Advance(Cursor &cursor) {
+  if (++cursor.index == cursor.leaf->key_num) {
+    cursor.leaf = cursor.leaf->next_leaf;
+    cursor.index = 0;
+  }
+  return;
+}
+
 bool
 BPlusTree::Insert(Node *node, KeyType const &key, RecordPointer const &value,
                   Node *&new_node, KeyType &new_key) {
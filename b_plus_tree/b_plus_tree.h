@@ -10,6 +10,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <functional>
 #include <queue>
 #include <string>
 #include <vector>
@@ -25,6 +26,13 @@ struct RecordPointer {
   RecordPointer(int page, int record) : page_id(page), record_id(record){};
 };
 
+// Callbacks receiving the output of set operations and joins between trees
+using ScanCallback =
+    std::function<void(const KeyType &, const RecordPointer &)>;
+using JoinCallback =
+    std::function<void(const KeyType &, const RecordPointer &,
+                       const RecordPointer &)>;
+
 // BPlusTree Node
 class Node {
 public:
@@ -59,6 +67,8 @@ public:
  * (2) Support insert & remove
  * (3) Support range scan, return multiple values.
  * (4) The structure should shrink and grow dynamically
+ * (5) Support merge-join and set operations against another tree by walking
+ *     both leaf chains in lockstep
  */
 
 class BPlusTree {
@@ -83,9 +93,30 @@ public:
   void RangeScan(const KeyType &key_start, const KeyType &key_end,
                  vector<RecordPointer> &result);
 
+  // equi-join on key with another tree, reporting both values of each match
+  void Join(BPlusTree &other, const JoinCallback &callback);
+
+  // keys present in both trees, reported with the value from this tree
+  void Intersect(BPlusTree &other, const ScanCallback &callback);
+
+  // keys present in either tree, preferring the value from this tree
+  void Union(BPlusTree &other, const ScanCallback &callback);
+
+  // keys present in this tree but not in the other one
+  void Difference(BPlusTree &other, const ScanCallback &callback);
+
 private:
 
+  // position of a key within the leaf chain, leaf is NULL past the last key
+  struct Cursor {
+    LeafNode *leaf;
+    int index;
+  };
+
   LeafNode* FindLeaf(KeyType const &key, bool is_predecessor = false);
+  LeafNode* FirstLeaf() const;
+  void Seek(Cursor &cursor, KeyType const &key);
+  static void Advance(Cursor &cursor);
   
   bool Insert(Node *node, KeyType const &key, RecordPointer const &value,
               Node *&new_node, KeyType &new_key);